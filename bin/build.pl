@@ -10,6 +10,7 @@ Usage: $0 [OPTIONS]
 Options:
   --build, -b     Run the build process (without tests)
   --test,  -t     Run the build process with tests
+  --bench, -p     Build and run the benchmarks (writes deltaFlowBench.json)
   --doc,   -d     Generate documentation
   --help,  -h     Show this help message and exit
 END_HELP
@@ -20,6 +21,7 @@ sub parse_args {
     my %args = (
         build => 0,
         test  => 0,
+        bench => 0,
         doc   => 0,
     );
 
@@ -33,6 +35,8 @@ sub parse_args {
             $args{build} = 1;
         } elsif ($arg eq '--test' || $arg eq '-t') {
             $args{test} = 1;
+        } elsif ($arg eq '--bench' || $arg eq '-p') {
+            $args{bench} = 1;
         } elsif ($arg eq '--doc' || $arg eq '-d') {
             $args{doc} = 1;
         } elsif ($arg eq '--help' || $arg eq '-h') {
@@ -51,7 +55,7 @@ open(my $fh, '<', 'version') or die "Cannot open version file: $!\n";
 chomp(my $version = <$fh>);
 close($fh);
 
-if ($args->{build} || $args->{test}) {
+if ($args->{build} || $args->{test} || $args->{bench}) {
     system("conan install . --output-folder=build --build=missing -s compiler.cppstd=17") == 0
         or die "Conan install failed\n";
 }
@@ -75,6 +79,16 @@ if ($args->{test}) {
     system("ctest --output-on-failure --test-dir build --build-config Release") == 0 or die "Tests failed\n";
 }
 
+if ($args->{bench}) {
+    print "Running benchmarks...\n";
+
+    system("cmake -S . -B build -DCMAKE_BUILD_TYPE=Release -DBUILD_BENCH=ON -DPROJECT_VERSION=$version") == 0
+        or die "CMake configuration failed\n";
+
+    system("cmake --build build --config Release --target deltaFlowBench") == 0 or die "Build failed\n";
+    system("./bin/deltaFlowBench --output deltaFlowBench.json") == 0 or die "Benchmarks failed\n";
+}
+
 if ($args->{doc}) {
     print "Building docs...\n";
 